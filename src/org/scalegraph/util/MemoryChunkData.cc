@@ -23,6 +23,7 @@ ExpMemGlobalState::ExpMemGlobalState() {
 	numCnt = 0;
 	gcThreshold = 1024*1024;
 	totalSize = 0;
+	numAllocs = 0;
 	gcWait = false;
 	pthread_mutex_init(&mutex, NULL);
 	pthread_cond_init(&sync, NULL);
@@ -37,6 +38,14 @@ x10_long get_gc_heap_size() {
 #endif
 		}
 
+x10_long get_gc_total_bytes() {
+#ifdef X10_USE_BDWGC
+			return GC_get_total_bytes();
+#else
+			return 0;
+#endif
+		}
+
 } } } // namespace org { namespace scalegraph { namespace util {
 
 /* END of MemoryChunkData */
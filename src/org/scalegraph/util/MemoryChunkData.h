@@ -43,6 +43,8 @@ namespace org { namespace scalegraph { namespace util {
 
 		struct ExpMemGlobalState {
 	        long numCnt, gcThreshold, totalSize, envThreshold;
+	        // the number of the explicit memory allocations since the start
+	        long numAllocs;
 	        bool gcWait;
 	        pthread_mutex_t mutex;
 	        pthread_cond_t sync;
@@ -55,6 +57,8 @@ namespace org { namespace scalegraph { namespace util {
 
 		x10_long get_gc_heap_size();
 
+		x10_long get_gc_total_bytes();
+
         struct ExplicitMemory{
 			x10_long byteSize;
 			void* pointer;
@@ -166,6 +170,7 @@ namespace org { namespace scalegraph { namespace util {
 				}
 
 				ExpMemState.totalSize += size;
+				++ExpMemState.numAllocs;
 				if( !ExpMemState.envThreshold && (ExpMemState.totalSize > ExpMemState.gcThreshold) ||
 					ExpMemState.envThreshold && (ExpMemState.totalSize > ExpMemState.envThreshold) ) {
 					// The guy who exceeded the threshold is responsible to invoke GC.